@@ -0,0 +1,55 @@
+#ifndef ENUMREGISTRY_HPP
+#define ENUMREGISTRY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+
+/// @brief Compile-time table mapping each value of an enum to a statically allocated config.
+/// @brief Entries are stored in enum order so lookup is a direct index. Check isComplete() in a static_assert where the table is declared.
+template<class Enum, class Config, size_t N>
+struct EnumRegistry
+{
+	struct Entry
+	{
+		Enum id;
+		const Config* config = nullptr;
+	};
+
+	std::array<Entry, N> entries;
+
+	/// @brief True if every enum value below N is mapped to a config, at its own index.
+	/// @return
+	constexpr bool isComplete() const
+	{
+		for (size_t i = 0; i < N; i++)
+		{
+			if (entries[i].id != static_cast<Enum>(i) || entries[i].config == nullptr)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/// @brief Get the config registered for an enum value.
+	/// @brief Asking for a value that has no config (e.g. a COUNT/NONE sentinel) aborts, in every build type.
+	/// @param id
+	/// @return
+	const Config& get(Enum id) const
+	{
+		const size_t index = static_cast<size_t>(id);
+
+		if (index >= N)
+		{
+			std::cerr << "EnumRegistry: no config is registered for enum value " << index << std::endl;
+			std::abort();
+		}
+
+		return *entries[index].config;
+	}
+};
+
+#endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "src/content/GameEntityDefinitions.hpp"
+#include "src/content/EnumRegistry.hpp"
 
 #include "src/entities/GameEntityConfig.hpp"
 #include "src/components/ComponentPool.hpp"
@@ -34,14 +35,9 @@ namespace GameEntities
 		});
 
 	static const GameEntityConfig BUTTON = GameEntityConfig()
-		.whenInit([](int entityUID, auto& scene)
+		.whenInit([](int, auto&)
 		{
-			TextConfig config;
-			config.textToDisplay = "Default Button Text";
-			config.centered = true;
-			config.margin = { .05f,.05f };
-			config.fontSize = 5;
-			scene.loadText(config, entityUID);
+			//Buttons have no default text, the scene loads each button's text when it places it.
 		});
 
 	static const GameEntityConfig RACCOON = GameEntityConfig()
@@ -483,41 +479,31 @@ namespace GameEntities
 		});
 }
 
+namespace GameEntities
+{
+	static constexpr EnumRegistry<GameEntityEnum, GameEntityConfig, static_cast<size_t>(GameEntityEnum::COUNT)> REGISTRY =
+	{{{
+		{ GameEntityEnum::TITLE_TEXT, &TITLE_TEXT },
+		{ GameEntityEnum::BUTTON, &BUTTON },
+		{ GameEntityEnum::RACCOON, &RACCOON },
+		{ GameEntityEnum::GOOSE, &GOOSE },
+		{ GameEntityEnum::FLOOR, &FLOOR },
+		{ GameEntityEnum::SKYBOX, &SKYBOX },
+		{ GameEntityEnum::BUSH, &BUSH },
+		{ GameEntityEnum::MUSHROOM, &MUSHROOM },
+		{ GameEntityEnum::TREE_1, &TREE_1 },
+		{ GameEntityEnum::TREE_2, &TREE_2 },
+		{ GameEntityEnum::LOG, &LOG },
+		{ GameEntityEnum::FIRE, &FIRE },
+		{ GameEntityEnum::SMOKE, &SMOKE },
+		{ GameEntityEnum::INVISIBLE_ENTITY, &INVISIBLE_ENTITY },
+		{ GameEntityEnum::FOLLOW_CAMERA, &FOLLOW_CAMERA }
+	}}};
+
+	static_assert(REGISTRY.isComplete(), "Every GameEntityEnum must be registered in GameEntities::REGISTRY, in enum order");
+}
+
 const GameEntityConfig& GameEntityDefinitions::get(GameEntityEnum gameEntity)
 {
-	switch (gameEntity)
-	{
-		case(GameEntityEnum::TITLE_TEXT):
-			return GameEntities::TITLE_TEXT;
-		case(GameEntityEnum::BUTTON):
-			return GameEntities::BUTTON;
-		case(GameEntityEnum::RACCOON):
-			return GameEntities::RACCOON;
-		case(GameEntityEnum::FLOOR):
-			return GameEntities::FLOOR;
-		case(GameEntityEnum::BUSH):
-			return GameEntities::BUSH;
-		case(GameEntityEnum::MUSHROOM):
-			return GameEntities::MUSHROOM;
-		case(GameEntityEnum::FIRE):
-			return GameEntities::FIRE;
-		case(GameEntityEnum::SMOKE):
-			return GameEntities::SMOKE;
-		case(GameEntityEnum::TREE_1):
-			return GameEntities::TREE_1;
-		case(GameEntityEnum::TREE_2):
-			return GameEntities::TREE_2;
-		case(GameEntityEnum::LOG):
-			return GameEntities::LOG;
-		case(GameEntityEnum::SKYBOX):
-			return GameEntities::SKYBOX;
-		case(GameEntityEnum::INVISIBLE_ENTITY):
-			return GameEntities::INVISIBLE_ENTITY;
-		case(GameEntityEnum::FOLLOW_CAMERA):
-			return GameEntities::FOLLOW_CAMERA;
-		case(GameEntityEnum::GOOSE):
-			return GameEntities::GOOSE;
-		default:
-			return GameEntities::BUSH; //quote unqoute
-	}
+	return GameEntities::REGISTRY.get(gameEntity);
 }
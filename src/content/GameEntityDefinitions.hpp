@@ -17,7 +17,8 @@ enum class GameEntityEnum
 	FIRE,
 	SMOKE,
 	INVISIBLE_ENTITY,
-	FOLLOW_CAMERA
+	FOLLOW_CAMERA,
+	COUNT //Not an entity. Keep this last, it sizes the entity registry.
 };
 
 struct GameEntityConfig;
@@ -25,7 +26,8 @@ struct GameEntityConfig;
 //To add a new game entity:
 // 0) Update GameEntityEnum to add an ID for your game entity
 // 1) Add a static GameEntityConfig variable for your enum to the GameEntities namespace in GameEntityDefinitions.cpp
-// 2) Add a mapping in get() for your enum to the variable created in #1
+// 2) Register the variable created in #1 in the REGISTRY table in GameEntityDefinitions.cpp, in enum order
+//    (the build fails with a static_assert if any enum is left unregistered or out of order)
 
 namespace GameEntityDefinitions
 {
@@ -1,5 +1,6 @@
 #include "src/content/SceneDefinitions.hpp"
 #include "src/content/GameEntityDefinitions.hpp"
+#include "src/content/EnumRegistry.hpp"
 
 #include "src/scenes/SceneConfig.hpp"
 #include "src/scenes/Scene.hpp"
@@ -20,6 +21,15 @@ namespace Scenes
 {
 	static const SceneConfig MAIN_MENU = SceneDefinitions::initSceneConfig(SceneEnum::MAIN_MENU);
 	static const SceneConfig LEVEL_1 = SceneDefinitions::initSceneConfig(SceneEnum::LEVEL_1);
+
+	//NONE is not a scene and has no config, so asking for it is an error
+	static constexpr EnumRegistry<SceneEnum, SceneConfig, static_cast<size_t>(SceneEnum::NONE)> REGISTRY =
+	{{{
+		{ SceneEnum::MAIN_MENU, &MAIN_MENU },
+		{ SceneEnum::LEVEL_1, &LEVEL_1 }
+	}}};
+
+	static_assert(REGISTRY.isComplete(), "Every SceneEnum except NONE must be registered in Scenes::REGISTRY, in enum order");
 }
 
 /// @brief Get a statically allocated scene configuration. This will be called from Scene:: when a new scene is requested.
@@ -28,14 +38,7 @@ namespace Scenes
 /// @return 
 const SceneConfig& SceneDefinitions::get(SceneEnum scene)
 {
-	switch (scene)
-	{
-		case(SceneEnum::LEVEL_1):
-			return Scenes::LEVEL_1;
-		case(SceneEnum::MAIN_MENU):
-		default:
-			return Scenes::MAIN_MENU;
-	}
+	return Scenes::REGISTRY.get(scene);
 }
 
 /// @brief Build a scene config for the scene. This should not be called directly except when statically initializing scenes.
@@ -70,7 +73,7 @@ const SceneConfig SceneDefinitions::initSceneConfig(SceneEnum scene)
 		auto player = config.addEntity(GameEntityDefinitions::get(GameEntityEnum::GOOSE));
 		player.addInitFn([](int entityUID, Scene& scene)
 		{
-			scene.addComponent<InputComponent>(entityUID);
+			//NB: GOOSE already adds its own InputComponent, don't add a second one here
 			scene.getComponent<TransformComponent>(entityUID).setTranslation({ 0.f,-4.8f,-2.f });
 		});
 
@@ -219,7 +222,6 @@ const SceneConfig SceneDefinitions::initSceneConfig(SceneEnum scene)
 		auto startButton = config.addEntity(GameEntityDefinitions::get(GameEntityEnum::BUTTON));
 		startButton.addInitFn([](int entityUID, Scene& scene)
 		{
-				//NB: right now this button loads its text twice since default buttons start with text. Maybe we dont want that?
 			TextConfig config;
 			config.textToDisplay = "click to begin";
 			config.centered = true;
@@ -247,18 +249,7 @@ const SceneConfig SceneDefinitions::initSceneConfig(SceneEnum scene)
 			});
 			trigger.setAction([](Scene& scene, int entityUID)
 			{
-				if (!scene.hasComponent<InputComponent>(entityUID))
-				{
-					return;
-				}
-				
-				std::optional<glm::vec2> coords = scene.getComponent<InputComponent>(entityUID).getInputActionWindowCoordinates(UserInputActionsEnum::LEFT_CLICKING);
-
-				if (coords.has_value())
-				{
-					std::cout << "Clicked on the start button in a manner of speaking, coords were " << coords.value().x << " " << coords.value().y << std::endl;
-				}
-
+				//The update condition already checked the input, so there's no need to look it up again here
 				scene.changeScene(SceneDefinitions::get(SceneEnum::LEVEL_1));
 			});
 
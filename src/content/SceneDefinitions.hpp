@@ -7,14 +7,15 @@ enum class SceneEnum
 {
 	MAIN_MENU,
 	LEVEL_1,
-	NONE
+	NONE //Not a scene, has no config. Keep this last, it sizes the scene registry.
 };
 
 //To add a new scene:
-// 0) Update SceneEnum.hpp to add an ID for your scene
-// 1) Add a mapping in getSceneConfig() for your enum
-// 3) Add a static SceneConfig variable for your enum to the Scenes namespace in SceneDefinitions.cpp
-// 3) Add a mapping and definition in initSceneConfig() for your enum
+// 0) Update SceneEnum to add an ID for your scene (before NONE)
+// 1) Add a static SceneConfig variable for your enum to the Scenes namespace in SceneDefinitions.cpp
+// 2) Register the variable created in #1 in the REGISTRY table in SceneDefinitions.cpp, in enum order
+//    (the build fails with a static_assert if any enum is left unregistered or out of order)
+// 3) Add a definition in initSceneConfig() for your enum
 namespace SceneDefinitions
 {
 	/// @brief Get a statically allocated scene configuration. This will be called from Scene:: when a new scene is requested.